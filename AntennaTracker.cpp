@@ -0,0 +1,188 @@
+#include "AntennaTracker.h"
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#else
+#define PROGMEM
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#endif
+
+// sin(0..90°) с шагом 1°, Q15
+static const int16_t SIN_TBL[91] PROGMEM = {
+      0,   572,  1144,  1715,  2286,  2856,  3425,  3993,  4560,  5126,
+   5690,  6252,  6813,  7371,  7927,  8481,  9032,  9580, 10126, 10668,
+  11207, 11743, 12275, 12803, 13328, 13848, 14364, 14876, 15383, 15886,
+  16383, 16876, 17364, 17846, 18323, 18794, 19260, 19720, 20173, 20621,
+  21062, 21497, 21925, 22347, 22762, 23170, 23571, 23964, 24351, 24730,
+  25101, 25465, 25821, 26169, 26509, 26841, 27165, 27481, 27788, 28087,
+  28377, 28659, 28932, 29196, 29451, 29697, 29934, 30162, 30381, 30591,
+  30791, 30982, 31163, 31335, 31498, 31650, 31794, 31927, 32051, 32165,
+  32269, 32364, 32448, 32523, 32587, 32642, 32687, 32722, 32747, 32762,
+  32767
+};
+
+// atan(i/32), i = 0..32, в тысячных градуса
+static const uint16_t ATAN_TBL[33] PROGMEM = {
+      0,  1790,  3576,  5356,  7125,  8881, 10620, 12339,
+  14036, 15709, 17354, 18970, 20556, 22109, 23629, 25115,
+  26565, 27979, 29358, 30700, 32005, 33275, 34509, 35707,
+  36870, 37999, 39094, 40156, 41186, 42184, 43152, 44091,
+  45000
+};
+
+// 1e-7 градуса по меридиану = 1.1131949 см; в Q16
+static const int32_t CM_PER_E7_Q16 = 72954;
+
+// ===== ЦЕЛОЧИСЛЕННАЯ ТРИГОНОМЕТРИЯ =====
+
+// sin первой четверти, r = 0..9000 сотых градуса, линейная интерполяция по таблице
+static int16_t sinQuarter_(uint16_t r) {
+  uint8_t  i = r / 100;
+  uint8_t  f = r % 100;
+  int16_t a = (int16_t)pgm_read_word(&SIN_TBL[i]);
+  if (!f) return a;
+  int16_t b = (int16_t)pgm_read_word(&SIN_TBL[i + 1]);
+  return a + (int16_t)(((int32_t)(b - a) * f) / 100);
+}
+
+int16_t AntennaTracker::sinQ15(uint16_t cdeg) {
+  cdeg %= 36000;
+  uint8_t  q = cdeg / 9000;
+  uint16_t r = cdeg % 9000;
+  switch (q) {
+    case 0:  return  sinQuarter_(r);
+    case 1:  return  sinQuarter_(9000 - r);
+    case 2:  return -sinQuarter_(r);
+    default: return -sinQuarter_(9000 - r);
+  }
+}
+
+int16_t AntennaTracker::cosQ15(uint16_t cdeg) {
+  return sinQ15((uint16_t)(((uint32_t)cdeg + 9000) % 36000));
+}
+
+// atan(z) для z = 0..1 (Q15), результат в сотых градуса.
+// Таблица с шагом 1/32 + линейная интерполяция, ошибка < 0.02° (test/)
+static int32_t atanUnit_(int32_t z) {
+  uint8_t  i = z >> 10;
+  uint16_t f = z & 1023;
+  int32_t a = pgm_read_word(&ATAN_TBL[i]);
+  if (f) {
+    int32_t b = pgm_read_word(&ATAN_TBL[i + 1]);
+    a += ((b - a) * f) >> 10;
+  }
+  return (a + 5) / 10;
+}
+
+int32_t AntennaTracker::atan2Cdeg(int32_t y, int32_t x) {
+  if (x == 0 && y == 0) return 0;
+  uint32_t ax = x < 0 ? (uint32_t)0 - (uint32_t)x : (uint32_t)x;
+  uint32_t ay = y < 0 ? (uint32_t)0 - (uint32_t)y : (uint32_t)y;
+  uint32_t mn = ax < ay ? ax : ay;
+  uint32_t mx = ax < ay ? ay : ax;
+  // чтобы mn<<15 влезло в 32 бита
+  while (mx > 0xFFFF) { mx >>= 1; mn >>= 1; }
+
+  int32_t a = atanUnit_((int32_t)((mn << 15) / mx));  // 0..4500
+  if (ay > ax) a = 9000 - a;
+  if (x < 0)   a = 18000 - a;
+  if (y < 0)   a = -a;
+  return a;
+}
+
+static uint32_t isqrt32_(uint32_t v) {
+  uint32_t r = 0, bit = 1UL << 30;
+  while (bit > v) bit >>= 2;
+  while (bit) {
+    if (v >= r + bit) { v -= r + bit; r = (r >> 1) + bit; }
+    else r >>= 1;
+    bit >>= 2;
+  }
+  return r;
+}
+
+uint32_t AntennaTracker::hypot32(int32_t a, int32_t b) {
+  uint32_t x = a < 0 ? (uint32_t)0 - (uint32_t)a : (uint32_t)a;
+  uint32_t y = b < 0 ? (uint32_t)0 - (uint32_t)b : (uint32_t)b;
+  // сдвигаем, чтобы x*x + y*y влезло в uint32 (46340^2 * 2 < 2^32); точность ~1/10000
+  uint8_t sh = 0;
+  while (x > 46340 || y > 46340) { x >>= 1; y >>= 1; sh++; }
+  return isqrt32_(x*x + y*y) << sh;
+}
+
+// ===== ТРЕКЕР =====
+
+void AntennaTracker::setHome(const GeoPoint& home) {
+  home_ = home;
+  homeSet_ = true;
+  if (fixSet_) projectFix();
+}
+
+void AntennaTracker::onAircraftFix(const GpsFix& fix, unsigned long nowMs) {
+  fix_   = fix;
+  fixMs_ = nowMs;
+  fixSet_ = true;
+
+  // скорость раскладываем один раз на фикс, а не каждый loop()
+  vn_ = ((int32_t)fix.groundSpeed_cms * cosQ15(fix.course_cdeg)) >> 15;
+  ve_ = ((int32_t)fix.groundSpeed_cms * sinQ15(fix.course_cdeg)) >> 15;
+  vu_ = fix.climb_cms;
+
+  if (homeSet_) projectFix();
+}
+
+void AntennaTracker::projectFix() {
+  // Equirectangular: на дальностях трекера (десятки км) ошибка много меньше
+  // ширины диаграммы антенны, а haversine без float на AVR не окупается.
+  int32_t dLat = fix_.pos.lat_e7 - home_.lat_e7;
+  int64_t dLon = (int64_t)fix_.pos.lon_e7 - home_.lon_e7;
+  if (dLon >  1800000000LL) dLon -= 3600000000LL;
+  if (dLon < -1800000000LL) dLon += 3600000000LL;
+
+  // масштаб по долготе — cos средней широты (1e-7° -> сотые градуса)
+  int32_t midLat = home_.lat_e7 + dLat / 2;
+  uint16_t midCdeg = (uint16_t)((midLat < 0 ? -midLat : midLat) / 100000);
+  int16_t cosLat = cosQ15(midCdeg);
+
+  // Схождение меридианов: азимут хорды отличается от начального азимута
+  // большого круга на dLon*sin(lat)/2 (на 70° широты и 30 км — до 0.4°)
+  int16_t sinLat = sinQ15(midCdeg);
+  if (midLat < 0) sinLat = -sinLat;
+  // после >>15 значение не больше |dLon| — делим уже в 32 битах (без __divdi3 на AVR)
+  convCdeg_ = (int32_t)((dLon * sinLat) >> 15) / 200000;   // 1e-7° -> сотые, /2
+
+  north_ = (int32_t)(((int64_t)dLat * CM_PER_E7_Q16) >> 16);
+  int32_t eq = (int32_t)((dLon * CM_PER_E7_Q16) >> 16);
+  east_  = (int32_t)(((int64_t)eq * cosLat) >> 15);
+  up_    = fix_.pos.alt_cm - home_.alt_cm;
+}
+
+const TrackResult& AntennaTracker::update(unsigned long nowMs) {
+  if (!homeSet_ || !fixSet_ || nowMs - fixMs_ > timeoutMs_) {
+    res_.valid = false;
+    return res_;
+  }
+
+  // Прогноз: где борт сейчас + упреждение на задержку линка
+  uint32_t dt = (nowMs - fixMs_) + leadMs_;
+  if (dt > maxPredictMs_) dt = maxPredictMs_;
+  int32_t n = north_ + vn_ * (int32_t)dt / 1000;
+  int32_t e = east_  + ve_ * (int32_t)dt / 1000;
+  int32_t u = up_    + vu_ * (int32_t)dt / 1000;
+
+  uint32_t horiz = hypot32(n, e);
+
+  // Борт прямо над антенной — азимут не трогаем
+  if (horiz) {
+    int32_t az = atan2Cdeg(e, n) - convCdeg_;   // от севера по часовой
+    if (az < 0) az += 36000;
+    if (az >= 36000) az -= 36000;
+    res_.azimuth_cdeg = (uint16_t)az;
+  }
+  res_.elevation_cdeg = (int16_t)atan2Cdeg(u, (int32_t)horiz);
+  res_.distance_m     = (horiz + 50) / 100;
+  res_.valid          = true;
+
+  if (onAim_) onAim_(res_.azimuth_cdeg, res_.elevation_cdeg);
+  return res_;
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <stdint.h>   // без Arduino.h — собирается и на ПК (test/)
+
+// Точка на земле: широта/долгота в 1e-7 градуса (как в CRSF/MAVLink), высота в см
+struct GeoPoint {
+  int32_t lat_e7;
+  int32_t lon_e7;
+  int32_t alt_cm;
+};
+
+// GPS-фикс борта (позиция + вектор скорости для прогноза между пакетами)
+struct GpsFix {
+  GeoPoint pos;
+  uint16_t groundSpeed_cms; // путевая скорость, см/с
+  uint16_t course_cdeg;     // курс 0..35999 (сотые градуса, от севера по часовой)
+  int16_t  climb_cms;       // вертикальная скорость, см/с (вверх = +)
+};
+
+// Результат наведения
+struct TrackResult {
+  bool     valid;           // есть дом и свежий фикс борта
+  uint16_t azimuth_cdeg;    // 0..35999, от севера по часовой
+  int16_t  elevation_cdeg;  // -9000..9000
+  uint32_t distance_m;      // расстояние по земле
+};
+
+// Колбэк на выход (серва/шаговик антенны), опционально
+typedef void (*OnTrackerAim)(uint16_t azimuth_cdeg, int16_t elevation_cdeg);
+
+// Трекер антенны: считает азимут/угол места/дистанцию от наземки до борта.
+// Вся математика целочисленная (equirectangular + быстрый atan2), без float.
+class AntennaTracker {
+public:
+  // Позиция наземной станции (можно звать на каждом фиксе наземного GPS)
+  void setHome(const GeoPoint& home);
+  bool hasHome() const { return homeSet_; }
+
+  // Новый фикс борта, nowMs — millis() в момент приёма
+  void onAircraftFix(const GpsFix& fix, unsigned long nowMs);
+
+  // Пересчёт на текущий момент (с прогнозом по скорости). Дёргать каждый loop().
+  // Время update()/onAircraftFix() на Mega не измерено — при сомнениях оберни в micros().
+  const TrackResult& update(unsigned long nowMs);
+  const TrackResult& result() const { return res_; }
+
+  void setCallback(OnTrackerAim onAim) { onAim_ = onAim; }
+
+  // Упреждение на задержку линка и ограничения прогноза.
+  // Прогноз не длиннее MAX_PREDICT_MS: 65535 см/с * 5000 мс ещё влезает в int32
+  static const uint16_t MAX_PREDICT_MS = 5000;
+  void setLeadMs(uint16_t ms)       { leadMs_ = ms; }
+  void setMaxPredictMs(uint16_t ms) { maxPredictMs_ = ms > MAX_PREDICT_MS ? MAX_PREDICT_MS : ms; }
+  void setTimeoutMs(uint16_t ms)    { timeoutMs_ = ms; }
+
+  // Целочисленная тригонометрия (углы в сотых градуса, результат Q15)
+  static int16_t  sinQ15(uint16_t cdeg);
+  static int16_t  cosQ15(uint16_t cdeg);
+  static int32_t  atan2Cdeg(int32_t y, int32_t x);   // -18000..18000
+  static uint32_t hypot32(int32_t a, int32_t b);
+
+private:
+  void projectFix();   // фикс борта -> локальные см относительно дома
+
+  GeoPoint home_{};
+  bool     homeSet_ = false;
+
+  GpsFix   fix_{};
+  unsigned long fixMs_ = 0;
+  bool     fixSet_ = false;
+
+  // Локальные координаты борта на момент фикса (см) и скорость (см/с)
+  int32_t north_ = 0, east_ = 0, up_ = 0;
+  int32_t vn_ = 0, ve_ = 0, vu_ = 0;
+  int32_t convCdeg_ = 0;   // поправка азимута на схождение меридианов
+
+  uint16_t leadMs_ = 100;        // типичная задержка телеметрии
+  uint16_t maxPredictMs_ = 1000; // дальше не экстраполируем
+  uint16_t timeoutMs_ = 3000;    // фикс старше — результат невалиден
+
+  TrackResult res_{ false, 0, 0, 0 };
+
+  OnTrackerAim onAim_ = nullptr;
+};
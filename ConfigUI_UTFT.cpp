@@ -13,16 +13,10 @@ static inline int imap_(int x,int in_min,int in_max,int out_min,int out_max){
   return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
 }
 
-// грубая закруглённая плашка
+// закруглённая плашка (через TftBus: углы отрезками, середина одним окном)
 void ConfigUI_UTFT::fillRoundRect(int x,int y,int w,int h,int r,uint8_t rC,uint8_t gC,uint8_t bC) {
-  setColor(rC,gC,bC);
-  tft_->fillRect(x+r, y,   x+w-r-1, y+h-1);
-  tft_->fillRect(x,   y+r, x+r-1,   y+h-r-1);
-  tft_->fillRect(x+w-r, y+r, x+w-1, y+h-r-1);
-  tft_->fillCircle(x+r,   y+r,   r);
-  tft_->fillCircle(x+w-r, y+r,   r);
-  tft_->fillCircle(x+r,   y+h-r, r);
-  tft_->fillCircle(x+w-r, y+h-r, r);
+  bus_.setColor(rC,gC,bC);
+  bus_.fillRoundRect(x, y, w, h, r);
 }
 
 // ===== ЖИЗНЕННЫЙ ЦИКЛ =====
@@ -33,6 +27,7 @@ void ConfigUI_UTFT::begin(UTFT& lcd,
                           uint16_t startY, uint16_t blockW)
 {
   tft_ = &lcd;
+  bus_.begin(lcd);
     // размеры с учётом выбранной ориентации в InitLCD()
   scrW_ = tft_->getDisplayXSize();
   scrH_ = tft_->getDisplayYSize();
@@ -84,8 +79,8 @@ void ConfigUI_UTFT::drawCurrentRow(int y, const char* text, const char* value) {
 
 void ConfigUI_UTFT::drawFrame(const char* title) {
   // 1) Полная подложка на весь экран
-  setColor(8,16,24); // COL_BG
-  tft_->fillRect(0, 0, scrW_-1, scrH_-1);
+  bus_.setColor(8,16,24); // COL_BG
+  bus_.fillRect(0, 0, scrW_-1, scrH_-1);
 
   // 2) Рассчитать центрирование по вертикали:
   //    Заголовок + 3 строки + два промежутка
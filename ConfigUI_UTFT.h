@@ -1,6 +1,7 @@
 #pragma once
 #include <Arduino.h>
 #include <UTFT.h>
+#include "TftBus.h"
 
 // Встроенные шрифты UTFT
 extern uint8_t SmallFont[];
@@ -88,6 +89,7 @@ private:
 
 private:
   UTFT* tft_ = nullptr;
+  TftBus bus_;   // быстрые заливки мимо UTFT
 
   // GPIO
   uint8_t pinUp_ = 0, pinDown_ = 0, pinLeft_ = 0, pinRight_ = 0;
@@ -17,20 +17,15 @@ void DisplayUI_UTFT::setColor(const RGB& c)     { tft_->setColor(c.r,c.g,c.b); }
 void DisplayUI_UTFT::setBackColor(const RGB& c) { tft_->setBackColor(c.r,c.g,c.b); }
 
 void DisplayUI_UTFT::fillRectR(int x,int y,int w,int h,const RGB& c) {
-  setColor(c);
-  tft_->fillRect(x, y, x+w-1, y+h-1);
+  if (w <= 0 || h <= 0) return;
+  bus_.setColor(c.r,c.g,c.b);
+  bus_.fillRect(x, y, x+w-1, y+h-1);
 }
 
 void DisplayUI_UTFT::fillRoundRectR(int x,int y,int w,int h,int r,const RGB& c) {
-  // Простейшая эмуляция: прямоугольник + 4 круга по углам
-  fillRectR(x+r, y,   w-2*r, h, c);
-  fillRectR(x,   y+r, r,     h-2*r, c);
-  fillRectR(x+w-r, y+r, r,   h-2*r, c);
-  setColor(c);
-  tft_->fillCircle(x+r,   y+r,   r);
-  tft_->fillCircle(x+w-r, y+r,   r);
-  tft_->fillCircle(x+r,   y+h-r, r);
-  tft_->fillCircle(x+w-r, y+h-r, r);
+  // углы отрезками, середина одним окном — без перекрытий
+  bus_.setColor(c.r,c.g,c.b);
+  bus_.fillRoundRect(x, y, w, h, r);
 }
 
 void DisplayUI_UTFT::drawRoundRectR(int x,int y,int w,int h,int r,const RGB& c) {
@@ -57,12 +52,12 @@ void DisplayUI_UTFT::begin(UTFT& lcd, uint8_t landscape, uint8_t cells) {
   // ИНИЦИАЛИЗАЦИЯ LCD как в UTFT (ты раньше так и делал)
   // Пример: myGLCD.InitLCD(LANDSCAPE);
   tft_->InitLCD(landscape ? LANDSCAPE : PORTRAIT);
+  bus_.begin(lcd);
 
   // Размеры (для LANDSCAPE — 480x320, для PORTRAIT — 320x480)
   if (landscape) { W_ = 480; H_ = 320; } else { W_ = 320; H_ = 480; }
 
-  // Фон и первичный фрейм
-  fillRectR(0,0,W_,H_, COL_BG);
+  // Первичный фрейм (фон заливает drawFrame)
   last_.cells = cells;
   tft_->setBackColor(VGA_TRANSPARENT);   // ← ВАЖНО: глобально прозрачный фон текста
   drawFrame();
@@ -146,9 +141,16 @@ void DisplayUI_UTFT::drawAzimuthCard(int az) {
   tft_->drawCircle(cx, cy, r);
   tft_->drawCircle(cx, cy, 2);
 
+  // нет фикса — без метки, вместо градусов "--"
+  if (az < 0) {
+    printAt(cx-8, rightY_+rightH_-14, "--", COL_TEXT, SmallFont);
+    return;
+  }
+
+  // азимут от севера (вверх) по часовой
   float rad = az * 3.1415926f / 180.0f;
-  int mx = cx + (int)(cos(rad) * (r-5));
-  int my = cy - (int)(sin(rad) * (r-5));
+  int mx = cx + (int)(sin(rad) * (r-5));
+  int my = cy - (int)(cos(rad) * (r-5));
 
   setColor(COL_OK);
   tft_->fillCircle(mx, my, 3);
@@ -1,6 +1,7 @@
 #pragma once
 #include <Arduino.h>
 #include <UTFT.h>
+#include "TftBus.h"
 
 // Эти шрифты есть в UTFT
 extern uint8_t SmallFont[];
@@ -17,7 +18,7 @@ struct UIData {
   const char* control; // "ELRS"/"CRSF"/"SBUS"...
   bool    recording;   // REC/STOP
   bool    v_bypass;    // ON/OFF
-  int16_t azimuth_deg; // 0..359
+  int16_t azimuth_deg; // 0..359, <0 — нет данных (нет/устарел фикс)
 };
 
 class DisplayUI_UTFT {
@@ -35,6 +36,7 @@ public:
 
 private:
   UTFT* tft_ = nullptr;
+  TftBus bus_;                 // быстрые заливки мимо UTFT
   int16_t W_ = 480, H_ = 320;  // под ILI9481 в LANDSCAPE
 
   // Геометрия
@@ -0,0 +1,131 @@
+#include "TftBus.h"
+
+#ifndef TFTBUS_HOST
+#include <Arduino.h>
+#include <UTFT.h>
+#endif
+
+// Прямой путь: Mega, стандартная разводка шилда — DB8..15 на PORTA, DB0..7 на PORTC
+#if !defined(TFTBUS_HOST) && (defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__))
+#define TFTBUS_DIRECT 1
+#else
+#define TFTBUS_DIRECT 0
+#endif
+
+#ifdef TFTBUS_HOST
+static const uint8_t SETXY_STROBES = 11;   // ILI9481: 3 команды + 8 байт координат
+#endif
+
+void TftBus::begin(UTFT& lcd) {
+#ifdef TFTBUS_HOST
+  (void)lcd;
+#else
+  lcd_ = &lcd;
+  direct_ = TFTBUS_DIRECT && lcd.display_transfer_mode == 16;
+#endif
+}
+
+void TftBus::setColor(uint8_t r, uint8_t g, uint8_t b) {
+  ch_ = (r & 248) | (g >> 5);
+  cl_ = ((g & 28) << 3) | (b >> 3);
+}
+
+// ===== НИЗКИЙ УРОВЕНЬ =====
+
+void TftBus::setWindow(int x1, int y1, int x2, int y2) {
+#ifdef TFTBUS_HOST
+  windows++;
+  strobes += SETXY_STROBES;
+  if (onWindow) onWindow(x1, y1, x2, y2);
+#else
+  *lcd_->P_CS &= ~lcd_->B_CS;
+  lcd_->setXY(x1, y1, x2, y2);    // поворот LANDSCAPE делает сам UTFT
+  *lcd_->P_RS |= lcd_->B_RS;      // дальше только данные
+#endif
+}
+
+void TftBus::stream(uint32_t pix) {
+#ifdef TFTBUS_HOST
+  strobes += pix;
+#else
+#if TFTBUS_DIRECT
+  if (direct_) {
+    PORTA = ch_;
+    PORTC = cl_;
+    // Строб — две записи порта без чтения (UTFT делает cbi/sbi через RMW).
+    // Порт WR пишется целиком: ISR не должны трогать соседние пины этого порта.
+    volatile uint8_t* wr = lcd_->P_WR;
+    const uint8_t hi = *wr | lcd_->B_WR;
+    const uint8_t lo = hi & ~lcd_->B_WR;
+#define TFT_STROBE() do { *wr = lo; *wr = hi; } while (0)
+    uint32_t blocks = pix >> 4;
+    uint8_t  rest   = pix & 15;
+    while (blocks--) {
+      TFT_STROBE(); TFT_STROBE(); TFT_STROBE(); TFT_STROBE();
+      TFT_STROBE(); TFT_STROBE(); TFT_STROBE(); TFT_STROBE();
+      TFT_STROBE(); TFT_STROBE(); TFT_STROBE(); TFT_STROBE();
+      TFT_STROBE(); TFT_STROBE(); TFT_STROBE(); TFT_STROBE();
+    }
+    while (rest--) TFT_STROBE();
+#undef TFT_STROBE
+    return;
+  }
+#endif
+  // не Mega / не 16 бит — переносимо, через UTFT
+  for (uint32_t i = 0; i < pix; i++) lcd_->LCD_Write_DATA(ch_, cl_);
+#endif
+}
+
+void TftBus::end() {
+#ifndef TFTBUS_HOST
+  *lcd_->P_CS |= lcd_->B_CS;
+#endif
+}
+
+// ===== ЗАЛИВКИ =====
+
+void TftBus::fillRect(int x1, int y1, int x2, int y2) {
+  if (x1 > x2) { int t = x1; x1 = x2; x2 = t; }
+  if (y1 > y2) { int t = y1; y1 = y2; y2 = t; }
+  setWindow(x1, y1, x2, y2);
+  stream((uint32_t)(x2 - x1 + 1) * (uint32_t)(y2 - y1 + 1));
+  end();
+}
+
+void TftBus::fillSpans(const TftSpan* s, uint16_t n) {
+  uint16_t i = 0;
+  while (i < n) {
+    // склеиваем подряд идущие строки с теми же x0..x1 в одно окно
+    uint16_t j = i + 1;
+    while (j < n && s[j].x0 == s[i].x0 && s[j].x1 == s[i].x1 && s[j].y == s[j-1].y + 1) j++;
+    if (s[i].x1 >= s[i].x0) {
+      setWindow(s[i].x0, s[i].y, s[i].x1, s[j-1].y);
+      stream((uint32_t)(s[i].x1 - s[i].x0 + 1) * (j - i));
+    }
+    i = j;
+  }
+  end();
+}
+
+// Закруглённая плашка без перекрытий: скругления — отрезками, середина — одним окном
+void TftBus::fillRoundRect(int x, int y, int w, int h, int r) {
+  if (w <= 0 || h <= 0) return;
+  if (r > w/2) r = w/2;
+  if (r > h/2) r = h/2;
+  if (r > MAX_CORNER_R) r = MAX_CORNER_R;
+  if (r < 0) r = 0;
+
+  TftSpan top[MAX_CORNER_R], bot[MAX_CORNER_R];
+  for (int i = 0; i < r; i++) {
+    int dy = r - i;
+    int dx = r;
+    while (dx*dx + dy*dy > r*r) dx--;
+    int inset = r - dx;
+    top[i]         = { (int16_t)(y + i),         (int16_t)(x + inset), (int16_t)(x + w - 1 - inset) };
+    bot[r - 1 - i] = { (int16_t)(y + h - 1 - i), (int16_t)(x + inset), (int16_t)(x + w - 1 - inset) };
+  }
+
+  fillSpans(top, r);
+  if (h > 2*r) fillRect(x, y + r, x + w - 1, y + h - 1 - r);
+  fillSpans(bot, r);
+}
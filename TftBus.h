@@ -0,0 +1,52 @@
+#pragma once
+#include <stdint.h>
+
+// Тонкий слой над шиной TFT32MEGA (16 бит, параллельная).
+// fillRect в UTFT уже открывает одно окно и льёт _fast_fill_16; здесь
+// выигрыш в стробе WR двумя записями порта вместо cbi/sbi (read-modify-write)
+// и без лишнего строба (pix%16)+1. Главное — закруглённые плашки: UTFT рисует
+// их кругами по строкам (окно на строку, с перекрытием), здесь — отрезками
+// без перекрытий, середина одним окном.
+//
+// -DTFTBUS_HOST — заглушка для ПК: в порты не пишет, считает стробы и окна
+// (test/tft_bus_host.cpp). Интерфейс тот же, UTFT игнорируется.
+
+class UTFT;
+
+// Горизонтальный отрезок: строка y, x0..x1 включительно
+struct TftSpan {
+  int16_t y, x0, x1;
+};
+
+class TftBus {
+public:
+  void begin(UTFT& lcd);
+
+  // Цвет как в UTFT::setColor (RGB888 -> 565)
+  void setColor(uint8_t r, uint8_t g, uint8_t b);
+
+  // Низкий уровень: окно (экранные координаты, включительно) и поток пикселей.
+  // Между setWindow() и end() CS держится активным.
+  void setWindow(int x1, int y1, int x2, int y2);
+  void stream(uint32_t pix);   // pix пикселей текущим цветом
+  void end();
+
+  // Заливки (CS берут/отпускают сами)
+  void fillRect(int x1, int y1, int x2, int y2);
+  void fillSpans(const TftSpan* s, uint16_t n);   // соседние одинаковые строки — одним окном
+  // Радиус зажимается в 0..min(w/2, h/2, MAX_CORNER_R); больший радиус даёт
+  // угол радиуса MAX_CORNER_R (буфер отрезков на стеке)
+  static const int MAX_CORNER_R = 16;
+  void fillRoundRect(int x, int y, int w, int h, int r);
+
+#ifdef TFTBUS_HOST
+  uint32_t strobes = 0;   // все стробы WR, включая команды setXY
+  uint32_t windows = 0;
+  void (*onWindow)(int x1, int y1, int x2, int y2) = nullptr;   // для проверки покрытия
+#endif
+
+private:
+  UTFT*   lcd_ = nullptr;
+  uint8_t ch_ = 0, cl_ = 0;   // цвет: старший/младший байт
+  bool    direct_ = false;    // прямой доступ к портам Mega
+};
@@ -1,6 +1,7 @@
 #include <UTFT.h>
 #include "ConfigUI_UTFT.h"
 #include "DisplayUI_UTFT.h"   // если используешь общий UI из прошлого шага
+#include "AntennaTracker.h"
 #include <EEPROM.h>
 
 
@@ -46,10 +47,16 @@ bool enPrev = false;
 // ===== модули UI =====
 ConfigUI_UTFT  cfgUI;
 DisplayUI_UTFT mainUI;   // если используешь основной экран
+AntennaTracker tracker;  // трекер антенны (азимут по GPS наземки и борта)
 
 // ===== колбэки =====
 void reco(uint8_t r) { /* твоя логика включить/выключить запись */ }
 void bypass_control(uint8_t b) { /* твоя логика bypass */ }
+void aimAntenna(uint16_t az_cdeg, int16_t el_cdeg) { /* твоя серва/шаговик */ }
+
+// ===== источники GPS (true = пришёл новый фикс) =====
+bool readGroundFix(GeoPoint& p)  { return false; /* GPS наземной станции */ }
+bool readAircraftFix(GpsFix& f)  { return false; /* GPS борта из телеметрии */ }
 
 float readVoltage_V() {
   const int pin = A0;
@@ -141,6 +148,8 @@ void setup() {
   cfgUI.setCallbacks(reco, bypass_control);
   cfgUI.resetCursor();
 
+  tracker.setCallback(aimAntenna);
+
 }
 
 
@@ -162,6 +171,15 @@ void loop() {
   }
   enPrev = enNow;
 
+  // --- трекер: антенна крутится и в режиме конфигурации ---
+  GeoPoint gp;
+  if (readGroundFix(gp)) tracker.setHome(gp);
+  GpsFix af;
+  if (readAircraftFix(af)) tracker.onAircraftFix(af, now);
+  const TrackResult& tr = tracker.update(now);
+  // нет/устарел фикс — -1, карточка AZIMUTH покажет "--"
+  int16_t azimuth = tr.valid ? ((tr.azimuth_cdeg + 50) / 100) % 360 : -1;
+
   // --- отрисовка ---
   if (editMode) {
     cfgUI.tick(cfg, true);     // меняем значения на лету, меню само перерисует строки
@@ -176,7 +194,7 @@ void loop() {
     d.control    = "ELRS";
     d.recording  = (cfg.record != 0);
     d.v_bypass   = (cfg.bypass != 0);
-    d.azimuth_deg = 120;
+    d.azimuth_deg = azimuth;
     mainUI.render(d);
   }
 
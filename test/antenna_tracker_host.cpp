@@ -0,0 +1,195 @@
+// Хост-тест AntennaTracker: целочисленная математика против double-эталона
+// (haversine + начальный азимут). Сборка: test/CMakeLists.txt
+#include "AntennaTracker.h"
+#include "check.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+static const double PI = 3.14159265358979323846;
+static const double R_EARTH_M = 6378137.0;
+
+// детерминированный ГСЧ, чтобы прогоны повторялись; lo..hi включительно
+static uint32_t rngState = 12345;
+static int32_t rnd(int32_t lo, int32_t hi) {
+  rngState = rngState * 1664525u + 1013904223u;
+  uint64_t span = (uint64_t)((int64_t)hi - lo) + 1;   // до 2^32, без переполнения int32
+  return (int32_t)((int64_t)lo + (int64_t)(((uint64_t)rngState * span) >> 32));
+}
+
+static double angDiffDeg(double a, double b) {
+  double d = fmod(fabs(a - b), 360.0);
+  return d > 180.0 ? 360.0 - d : d;
+}
+
+static void testSinCos() {
+  int maxErr = 0;
+  for (uint32_t c = 0; c < 36000; c++) {
+    double rad = c / 100.0 * PI / 180.0;
+    int es = abs(AntennaTracker::sinQ15((uint16_t)c) - (int)lround(sin(rad) * 32767));
+    int ec = abs(AntennaTracker::cosQ15((uint16_t)c) - (int)lround(cos(rad) * 32767));
+    if (es > maxErr) maxErr = es;
+    if (ec > maxErr) maxErr = ec;
+  }
+  printf("sin/cos Q15: max error %d LSB\n", maxErr);
+  CHECK(maxErr <= 3, "sin/cos error %d LSB > 3", maxErr);
+  // углы за 360° заворачиваются
+  CHECK(AntennaTracker::sinQ15(36000 + 9000) == AntennaTracker::sinQ15(9000), "sin wrap");
+  CHECK(AntennaTracker::cosQ15(65535) == AntennaTracker::cosQ15(65535 % 36000), "cos wrap");
+}
+
+static double atanErr(int32_t y, int32_t x) {
+  double ref = atan2((double)y, (double)x) * 18000.0 / PI;
+  return angDiffDeg(ref / 100.0, AntennaTracker::atan2Cdeg(y, x) / 100.0);
+}
+
+static void testAtan2() {
+  // оси и диагонали
+  CHECK(AntennaTracker::atan2Cdeg(0, 0)     == 0,      "atan2(0,0)");
+  CHECK(AntennaTracker::atan2Cdeg(0, 5)     == 0,      "atan2 +x");
+  CHECK(AntennaTracker::atan2Cdeg(5, 0)     == 9000,   "atan2 +y");
+  CHECK(AntennaTracker::atan2Cdeg(0, -5)    == 18000,  "atan2 -x");
+  CHECK(AntennaTracker::atan2Cdeg(-5, 0)    == -9000,  "atan2 -y");
+  CHECK(AntennaTracker::atan2Cdeg(7, 7)     == 4500,   "atan2 45");
+  CHECK(AntennaTracker::atan2Cdeg(-7, -7)   == -13500, "atan2 -135");
+
+  // крайние значения
+  CHECK(AntennaTracker::atan2Cdeg(INT32_MIN, 0)         == -9000, "atan2 INT32_MIN y");
+  CHECK(AntennaTracker::atan2Cdeg(0, INT32_MIN)         == 18000, "atan2 INT32_MIN x");
+  CHECK(atanErr(INT32_MIN, INT32_MIN) < 0.02,                     "atan2 INT32_MIN both");
+  CHECK(atanErr(INT32_MAX, INT32_MIN) < 0.02,                     "atan2 MAX/MIN");
+  CHECK(atanErr(1, INT32_MAX) < 0.02,                             "atan2 tiny/huge");
+
+  // все октанты, разные масштабы
+  double maxErr = 0;
+  for (int i = 0; i < 400000; i++) {
+    int32_t m = (i % 4 == 0) ? 100 : (i % 4 == 1) ? 100000 : (i % 4 == 2) ? 30000000 : 2000000000;
+    int32_t y = rnd(-m, m), x = rnd(-m, m);
+    if (!x && !y) continue;
+    double e = atanErr(y, x);
+    if (e > maxErr) maxErr = e;
+  }
+  printf("atan2Cdeg: max error %.4f deg\n", maxErr);
+  CHECK(maxErr < 0.02, "atan2 error %.4f deg >= 0.02", maxErr);
+}
+
+static void testHypot() {
+  CHECK(AntennaTracker::hypot32(0, 0) == 0,          "hypot 0");
+  CHECK(AntennaTracker::hypot32(3, -4) == 5,         "hypot 3-4-5");
+  CHECK(AntennaTracker::hypot32(INT32_MIN, 0) >= 2147000000u, "hypot INT32_MIN");
+
+  double maxRel = 0;
+  for (int i = 0; i < 200000; i++) {
+    int32_t m = (i & 1) ? 30000 : 300000000;
+    int32_t a = rnd(-m, m), b = rnd(-m, m);
+    double ref = sqrt((double)a * a + (double)b * b);
+    double got = AntennaTracker::hypot32(a, b);
+    double err = fabs(ref - got);
+    if (ref < 32768) {
+      CHECK(err <= 1.0, "hypot(%d,%d) = %.0f, ref %.2f", (int)a, (int)b, got, ref);
+    } else if (err / ref > maxRel) {
+      maxRel = err / ref;
+    }
+  }
+  printf("hypot32: max relative error %.6f\n", maxRel);
+  CHECK(maxRel < 1.0 / 10000, "hypot relative error %.6f", maxRel);
+}
+
+// Эталон: haversine-дистанция по земле и начальный азимут
+static void reference(const GeoPoint& h, const GeoPoint& p, double& dist_m, double& az_deg) {
+  double la1 = h.lat_e7 * 1e-7 * PI / 180, la2 = p.lat_e7 * 1e-7 * PI / 180;
+  double dl  = (p.lon_e7 - (double)h.lon_e7) * 1e-7 * PI / 180;
+  double a = pow(sin((la2 - la1) / 2), 2) + cos(la1) * cos(la2) * pow(sin(dl / 2), 2);
+  dist_m = 2 * R_EARTH_M * asin(sqrt(a));
+  az_deg = atan2(sin(dl) * cos(la2), cos(la1) * sin(la2) - sin(la1) * cos(la2) * cos(dl)) * 180 / PI;
+  if (az_deg < 0) az_deg += 360;
+}
+
+static void testUpdate() {
+  double maxAz = 0, maxEl = 0, maxDist = 0;
+  for (int i = 0; i < 100000; i++) {
+    // дом где угодно до ±70° широты, борт в пределах ~30 км
+    GeoPoint h{ rnd(-700000000, 700000000), rnd(-1800000000, 1799999999), rnd(0, 300000) };
+    int32_t dLat = rnd(-2700000, 2700000);
+    int32_t dLon = rnd(-2700000, 2700000);
+    GpsFix f{};
+    f.pos.lat_e7 = h.lat_e7 + dLat;
+    int64_t lon = (int64_t)h.lon_e7 + dLon;
+    if (lon >= 1800000000LL) lon -= 3600000000LL;
+    if (lon < -1800000000LL) lon += 3600000000LL;
+    f.pos.lon_e7 = (int32_t)lon;
+    f.pos.alt_cm = h.alt_cm + rnd(-5000, 300000);
+
+    double dist, az;
+    reference(h, f.pos, dist, az);
+    if (dist > 30000.0 || dist < 200.0) continue;
+
+    AntennaTracker t;
+    t.setHome(h);
+    t.setLeadMs(0);
+    t.onAircraftFix(f, 1000);
+    const TrackResult& r = t.update(1000);
+    CHECK(r.valid, "result invalid");
+
+    double el = atan2((f.pos.alt_cm - h.alt_cm) / 100.0, dist) * 180 / PI;
+    double eAz = angDiffDeg(az, r.azimuth_cdeg / 100.0);
+    double eEl = fabs(el - r.elevation_cdeg / 100.0);
+    double eD  = fabs(dist - r.distance_m);
+    if (eAz > maxAz) maxAz = eAz;
+    if (eEl > maxEl) maxEl = eEl;
+    if (eD / dist > maxDist) maxDist = eD / dist;
+  }
+  printf("update(): max error az %.4f deg, el %.4f deg, dist %.5f\n", maxAz, maxEl, maxDist);
+  CHECK(maxAz < 0.05,     "azimuth error %.4f deg", maxAz);
+  CHECK(maxEl < 0.05,     "elevation error %.4f deg", maxEl);
+  CHECK(maxDist < 0.005,  "distance error %.5f", maxDist);
+}
+
+static void testPrediction() {
+  GeoPoint h{ 550000000, 830000000, 0 };
+  AntennaTracker t;
+  t.setHome(h);
+  t.setLeadMs(0);
+
+  // 20 м/с на восток, фикс в точке дома, через 500 мс — 10 м на восток
+  GpsFix f{};
+  f.pos = h;
+  f.groundSpeed_cms = 2000;
+  f.course_cdeg = 9000;
+  t.onAircraftFix(f, 0);
+  const TrackResult& r = t.update(500);
+  CHECK(r.valid, "prediction invalid");
+  CHECK(r.azimuth_cdeg == 9000, "prediction az %u", (unsigned)r.azimuth_cdeg);
+  CHECK(r.distance_m == 10, "prediction dist %u", (unsigned)r.distance_m);
+
+  // прогноз ограничен maxPredictMs
+  const TrackResult& r2 = t.update(900);
+  CHECK(r2.distance_m == 18, "dt 900 dist %u", (unsigned)r2.distance_m);
+  t.setMaxPredictMs(200);
+  CHECK(t.update(900).distance_m == 4, "capped dist %u", (unsigned)t.update(900).distance_m);
+
+  // устаревший фикс — невалидно
+  CHECK(!t.update(5000).valid, "stale fix must be invalid");
+
+  // предел прогноза зажат, максимальная скорость не переполняет int32
+  t.setMaxPredictMs(60000);
+  t.setTimeoutMs(60000);
+  f.groundSpeed_cms = 65535;
+  f.course_cdeg = 0;
+  t.onAircraftFix(f, 0);
+  const TrackResult& r3 = t.update(60000);
+  uint32_t expect = (uint32_t)(65535UL * AntennaTracker::MAX_PREDICT_MS / 1000 / 100);
+  CHECK(r3.valid && r3.azimuth_cdeg == 0, "fast north az %u", (unsigned)r3.azimuth_cdeg);
+  CHECK(r3.distance_m + 1 >= expect && r3.distance_m <= expect + 1,
+        "fast north dist %u, want ~%u", (unsigned)r3.distance_m, (unsigned)expect);
+}
+
+int main() {
+  testSinCos();
+  testAtan2();
+  testHypot();
+  testUpdate();
+  testPrediction();
+  return checkResult();
+}
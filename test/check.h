@@ -0,0 +1,19 @@
+#pragma once
+// Минимальные проверки для хост-тестов: CHECK копит ошибки, checkResult() — код выхода main().
+#include <stdio.h>
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do {                                  \
+  if (!(cond)) {                                               \
+    printf("FAIL %s:%d: ", __FILE__, __LINE__);                \
+    printf(__VA_ARGS__); printf("\n");                         \
+    failures++;                                                \
+  }                                                            \
+} while (0)
+
+static int checkResult() {
+  if (failures) { printf("%d check(s) failed\n", failures); return 1; }
+  printf("OK\n");
+  return 0;
+}
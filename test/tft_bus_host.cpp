@@ -0,0 +1,111 @@
+// Хост-тест TftBus (-DTFTBUS_HOST): считает окна/стробы и проверяет покрытие пикселей.
+#include "TftBus.h"
+#include "check.h"
+
+#include <string.h>
+
+class UTFT {};   // на ПК заглушке дисплей не нужен
+
+static const int SCR_W = 480, SCR_H = 320;
+static const uint32_t SETXY_STROBES = 11;
+
+// сколько раз закрашен каждый пиксель
+static uint8_t cover[SCR_H][SCR_W];
+static uint32_t windowArea = 0;
+
+static void paintWindow(int x1, int y1, int x2, int y2) {
+  for (int y = y1; y <= y2; y++)
+    for (int x = x1; x <= x2; x++)
+      if (x >= 0 && x < SCR_W && y >= 0 && y < SCR_H) cover[y][x]++;
+  windowArea += (uint32_t)(x2 - x1 + 1) * (uint32_t)(y2 - y1 + 1);
+}
+
+static void reset(TftBus& b) {
+  memset(cover, 0, sizeof(cover));
+  windowArea = 0;
+  b.strobes = 0;
+  b.windows = 0;
+}
+
+// пиксель внутри плашки: от угла скругления не дальше r
+static bool insideRoundRect(int px, int py, int x, int y, int w, int h, int r) {
+  if (px < x || px >= x + w || py < y || py >= y + h) return false;
+  int kx = 0, ky = 0;
+  if (px < x + r)         kx = x + r - px;
+  if (px > x + w - 1 - r) kx = px - (x + w - 1 - r);
+  if (py < y + r)         ky = y + r - py;
+  if (py > y + h - 1 - r) ky = py - (y + h - 1 - r);
+  return kx*kx + ky*ky <= r*r;
+}
+
+static void testFullScreen(TftBus& b) {
+  reset(b);
+  b.fillRect(0, 0, SCR_W - 1, SCR_H - 1);
+  CHECK(b.windows == 1, "full screen: %u windows", (unsigned)b.windows);
+  CHECK(b.strobes == 153600u + SETXY_STROBES, "full screen: %u strobes", (unsigned)b.strobes);
+
+  // перевёрнутые координаты — как в UTFT
+  reset(b);
+  b.fillRect(10, 20, 0, 0);
+  CHECK(b.windows == 1 && b.strobes == 11u * 21u + SETXY_STROBES, "swapped rect: %u strobes", (unsigned)b.strobes);
+}
+
+static void testRoundRect(TftBus& b, int x, int y, int w, int h, int r) {
+  reset(b);
+  b.fillRoundRect(x, y, w, h, r);
+
+  int rr = r;   // как зажимает TftBus
+  if (rr > w/2) rr = w/2;
+  if (rr > h/2) rr = h/2;
+  if (rr > TftBus::MAX_CORNER_R) rr = TftBus::MAX_CORNER_R;
+  if (rr < 0) rr = 0;
+
+  uint32_t overdraw = 0, missing = 0, extra = 0;
+  for (int py = 0; py < SCR_H; py++)
+    for (int px = 0; px < SCR_W; px++) {
+      bool in = insideRoundRect(px, py, x, y, w, h, rr);
+      if (cover[py][px] > 1) overdraw++;
+      if (in && !cover[py][px]) missing++;
+      if (!in && cover[py][px]) extra++;
+    }
+
+  CHECK(b.windows <= (uint32_t)(2*rr + 1), "round %dx%d r=%d: %u windows > 2r+1",
+        w, h, r, (unsigned)b.windows);
+  CHECK(!overdraw && !missing && !extra, "round %dx%d r=%d: overdraw %u, missing %u, extra %u",
+        w, h, r, (unsigned)overdraw, (unsigned)missing, (unsigned)extra);
+  // в каждое окно ушло ровно его число пикселей
+  CHECK(b.strobes == windowArea + b.windows * SETXY_STROBES, "round %dx%d r=%d: %u strobes, want %u",
+        w, h, r, (unsigned)b.strobes, (unsigned)(windowArea + b.windows * SETXY_STROBES));
+}
+
+static void testSpans(TftBus& b) {
+  // три строки подряд с одинаковым x — одно окно; разрыв по y — новое
+  const TftSpan s[] = { {10, 5, 20}, {11, 5, 20}, {12, 5, 20}, {14, 5, 20}, {15, 6, 20}, {16, 9, 8} };
+  reset(b);
+  b.fillSpans(s, sizeof(s) / sizeof(s[0]));
+  CHECK(b.windows == 3, "spans: %u windows", (unsigned)b.windows);
+  CHECK(b.strobes == 16u*3 + 16u + 15u + 3 * SETXY_STROBES, "spans: %u strobes", (unsigned)b.strobes);
+
+  reset(b);
+  b.fillRoundRect(0, 0, 0, 10, 3);
+  CHECK(b.windows == 0 && b.strobes == 0, "empty round rect drew something");
+}
+
+int main() {
+  UTFT lcd;
+  TftBus b;
+  b.begin(lcd);
+  b.onWindow = paintWindow;
+  b.setColor(8, 16, 24);
+
+  testFullScreen(b);
+  testRoundRect(b, 16, 72, 300, 28, 6);    // строки DisplayUI
+  testRoundRect(b, 284, 194, 160, 36, 8);  // «пилюля» ConfigUI
+  testRoundRect(b, 20, 20, 40, 12, 10);    // r больше h/2
+  testRoundRect(b, 100, 100, 50, 50, 0);   // без скругления
+  testRoundRect(b, 150, 150, 120, 80, 30); // r больше MAX_CORNER_R
+  testRoundRect(b, 10, 200, 30, 20, -5);   // отрицательный r — как 0
+  testSpans(b);
+
+  return checkResult();
+}